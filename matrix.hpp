@@ -27,6 +27,10 @@
 #include <stdexcept> // std::length_error, std::out_of_range, std::invalid_argument
 #include <type_traits> // std::is_arithmetic
 #include <string> // std::string
+#include <vector> // std::vector
+#include <cstdint> // std::uint64_t
+#include <functional> // std::reference_wrapper
+#include <initializer_list> // std::initializer_list
 
 #if defined(__GNUC__) && !defined(__APPLE__)
 #include <bits/functexcept.h> // std::throw_out_of_range_fmt
@@ -35,6 +39,7 @@
 
 #ifdef _MSC_VER
 #include <yvals.h> // _STL_REPORT_ERROR, _STL_VERIFY
+#include <intrin.h> // __popcnt64
 #endif // _MSC_VER
 
 
@@ -76,7 +81,7 @@ namespace detail
     }
 
     template<typename T>
-    void InitializeDM(T**& to, const T** from, const std::size_t& rows, const std::size_t& cols)
+    void InitializeDM(T**& to, const T* const* from, const std::size_t& rows, const std::size_t& cols)
         /* Аналогично CreateDM. Инициализацию от 1-мерного массива и инициализирующего значения
            не стал добавлять т.к. я их использую всего 1 раз. */
     {
@@ -89,9 +94,11 @@ namespace detail
         }
     }
 
-    template<typename T>
-    void RangeCheck(const Matrix<T>& matrix, const std::size_t& row, const std::size_t& col)
-        /* Функция RangeCheck. Проверяет, не вышли ли row и col за границы матрицы.
+    template<typename MatrixType>
+    void RangeCheck(const MatrixType& matrix, const std::size_t& row, const std::size_t& col,
+                    const std::string& whatClass)
+        /* Функция RangeCheck. Проверяет, не вышли ли row и col за границы матрицы
+           (Matrix или BitMatrix, имя класса для сообщения передаётся в whatClass).
            В случае выхода бросается исключение std::out_of_range */
     {
         if (row >= matrix.Rows() || col >= matrix.Columns())
@@ -100,24 +107,24 @@ namespace detail
             if (row >= matrix.Rows())
             {
 #if defined(__GNUC__) && !defined(__APPLE__)
-                std::__throw_out_of_range_fmt(__N("In Matrix::At(row, col): "
+                std::__throw_out_of_range_fmt(__N("In %s::At(row, col): "
                                                   "row (which is %zu) >= this->Rows() "
                                                   "(which is %zu)"),
-                                              row, matrix.Rows());
+                                              whatClass.c_str(), row, matrix.Rows());
 #else  // Если используется другой компиляор (не GNU) или используется macOS
-                throw std::out_of_range("In Matrix::At(row, col): row >= "
+                throw std::out_of_range("In " + whatClass + "::At(row, col): row >= "
                                         "this->Rows()");
 #endif // defined(__GNUC__) && !defined(__APPLE__)
             }
             if (col >= matrix.Columns())
             {
 #if defined(__GNUC__) && !defined(__APPLE__)
-                std::__throw_out_of_range_fmt(__N("In Matrix::At(row, col): "
+                std::__throw_out_of_range_fmt(__N("In %s::At(row, col): "
                                                   "col (which is %zu) >= this->Columns() "
                                                   "(which is %zu)"),
-                                              col, matrix.Columns());
+                                              whatClass.c_str(), col, matrix.Columns());
 #else  // Если используется другой компиляор (не GNU) или используется macOS
-                throw std::out_of_range("In Matrix::At(row, col): col >= "
+                throw std::out_of_range("In " + whatClass + "::At(row, col): col >= "
                                         "this->Columns()");
 #endif // defined(__GNUC__) && !defined(__APPLE__)
             }
@@ -236,6 +243,150 @@ namespace detail
 #else
             throw std::invalid_argument("In operator" + whatOperator + ": Matrix have null size."
                                         " (Matrix's size mustn't be null).");
+#endif
+        }
+    }
+
+    template<typename T, typename U, typename V>
+    void CheckGemmPossiblity(const Matrix<U>& a, bool transposeA, const Matrix<V>& b, bool transposeB,
+                             const Matrix<T>& c)
+        /* Аналог CheckMatrix_matrixMultiplicationPossiblity для Gemm. Размеры сравниваются с учётом
+           флагов транспонирования, дополнительно проверяется, что c не совпадает с a или b
+           (иначе результат затрёт ещё не прочитанные элементы). */
+    {
+        if (!std::is_arithmetic<T>::value || !std::is_arithmetic<U>::value ||
+            !std::is_arithmetic<V>::value)
+        {
+#ifdef _MSC_VER
+            _STL_REPORT_ERROR("Wrong template arguments of matrix (to use Gemm "
+                              "template arguments of all matrices must be arithmetic).");
+#else // Если используется не компилятор Microsoft
+            throw std::invalid_argument("In Gemm: template argument of matrix is not arithmetic. "
+                                        "(All template arguments must be arithmetic).");
+#endif // _MSC_VER
+        }
+        if (a.Rows() == 0 || b.Rows() == 0 || c.Rows() == 0) // см. CheckArithmeticOperationPossiblity
+        {
+#ifdef _MSC_VER
+            _STL_REPORT_ERROR("Marix have null size. To use Gemm Matrix's size mustn't be null");
+#else
+            throw std::invalid_argument("In Gemm: Matrix have null size."
+                                        " (Matrix's size mustn't be null).");
+#endif
+        }
+        const std::size_t innerA = transposeA ? a.Rows() : a.Columns();
+        const std::size_t innerB = transposeB ? b.Columns() : b.Rows();
+        if (innerA != innerB)
+        {
+#ifdef _MSC_VER
+            _STL_REPORT_ERROR("Wrong matrices size (to use Gemm columns of op(a) "
+                              "must be equal to op(b) rows).");
+#else // Если используется не компилятор Microsoft
+            throw std::invalid_argument("In Gemm: op(a).Columns() is not equal to op(b).Rows(). "
+                                        "(It must be equal).");
+#endif // _MSC_VER
+        }
+        const std::size_t rows = transposeA ? a.Columns() : a.Rows();
+        const std::size_t cols = transposeB ? b.Rows() : b.Columns();
+        if (c.Rows() != rows || c.Columns() != cols)
+        {
+#ifdef _MSC_VER
+            _STL_REPORT_ERROR("Wrong matrices size (to use Gemm \"c\" must have "
+                              "op(a).Rows() rows and op(b).Columns() columns).");
+#else // Если используется не компилятор Microsoft
+            throw std::invalid_argument("In Gemm: size of \"c\" is not equal to "
+                                        "op(a).Rows() x op(b).Columns(). (It must be equal).");
+#endif // _MSC_VER
+        }
+        if (static_cast<const void*>(&c) == static_cast<const void*>(&a) ||
+            static_cast<const void*>(&c) == static_cast<const void*>(&b))
+        {
+#ifdef _MSC_VER
+            _STL_REPORT_ERROR("In Gemm \"c\" mustn't be the same matrix as \"a\" or \"b\".");
+#else // Если используется не компилятор Microsoft
+            throw std::invalid_argument("In Gemm: \"c\" is the same matrix as \"a\" or \"b\". "
+                                        "(It mustn't be).");
+#endif // _MSC_VER
+        }
+    }
+
+    template<typename T>
+    void CheckMultiplyChainPossiblity(const std::vector<const Matrix<T>*>& chain)
+        // Аналог CheckMatrix_matrixMultiplicationPossiblity для цепочки матриц (см. MultiplyChain)
+    {
+        if (!std::is_arithmetic<T>::value)
+        {
+#ifdef _MSC_VER
+            _STL_REPORT_ERROR("Wrong template argument of matrix (to use MultiplyChain "
+                              "template argument of matrices must be arithmetic).");
+#else // Если используется не компилятор Microsoft
+            throw std::invalid_argument("In MultiplyChain: template argument of matrix is not arithmetic. "
+                                        "(It must be arithmetic).");
+#endif // _MSC_VER
+        }
+        if (chain.empty())
+        {
+#ifdef _MSC_VER
+            _STL_REPORT_ERROR("Empty chain. To use MultiplyChain chain mustn't be empty");
+#else
+            throw std::invalid_argument("In MultiplyChain: chain is empty."
+                                        " (It mustn't be empty).");
+#endif
+        }
+        for (std::size_t i = 0; i < chain.size(); i++)
+        {
+            if (chain[i]->Rows() == 0)
+            {
+#ifdef _MSC_VER
+                _STL_REPORT_ERROR("Marix have null size. To use MultiplyChain Matrix's size mustn't be null");
+#else
+                throw std::invalid_argument("In MultiplyChain: Matrix have null size."
+                                            " (Matrix's size mustn't be null).");
+#endif
+            }
+            if (i + 1 < chain.size() && chain[i]->Columns() != chain[i + 1]->Rows())
+            {
+#ifdef _MSC_VER
+                _STL_REPORT_ERROR("Wrong matrices size (to use MultiplyChain columns of each matrix "
+                                  "must be equal to rows of the next one).");
+#else // Если используется не компилятор Microsoft
+                throw std::invalid_argument("In MultiplyChain: Columns() of matrix is not equal to "
+                                            "Rows() of the next matrix. (It must be equal).");
+#endif // _MSC_VER
+            }
+        }
+    }
+
+    template<typename T>
+    void CheckPowerPossiblity(const Matrix<T>& matrix)
+        // Проверяет, можно ли возвести матрицу в степень (см. Power)
+    {
+        if (!std::is_arithmetic<T>::value)
+        {
+#ifdef _MSC_VER
+            _STL_REPORT_ERROR("Wrong template argument of matrix (to use Power "
+                              "template argument of matrix must be arithmetic).");
+#else // Если используется не компилятор Microsoft
+            throw std::invalid_argument("In Power: template argument of matrix is not arithmetic. "
+                                        "(It must be arithmetic).");
+#endif // _MSC_VER
+        }
+        if (matrix.Rows() != matrix.Columns())
+        {
+#ifdef _MSC_VER
+            _STL_REPORT_ERROR("Wrong matrix size (to use Power matrix must be square).");
+#else // Если используется не компилятор Microsoft
+            throw std::invalid_argument("In Power: matrix.Rows() is not equal to matrix.Columns(). "
+                                        "(Matrix must be square).");
+#endif // _MSC_VER
+        }
+        if (matrix.Rows() == 0)
+        {
+#ifdef _MSC_VER
+            _STL_REPORT_ERROR("Marix have null size. To use Power Matrix's size mustn't be null");
+#else
+            throw std::invalid_argument("In Power: Matrix have null size."
+                                        " (Matrix's size mustn't be null).");
 #endif
         }
     }
@@ -250,7 +401,7 @@ public:
     typedef T*              Pointer;
     typedef const T*        ConstPointer;
     typedef T**             DoublePointer;
-    typedef const T**       ConstDoublePointer;
+    typedef const T* const* ConstDoublePointer;
     typedef T&              Reference;
     typedef const T&        ConstReference;
     typedef std::size_t     SizeType;
@@ -438,14 +589,14 @@ public:
     Reference At(const SizeType& row, const SizeType& col)
         // Метод At. Безопасная, но медленная замена оператору индексирования
     {
-        detail::RangeCheck(*this, row, col);
+        detail::RangeCheck(*this, row, col, static_cast<std::string>("Matrix"));
         return this->PMem_data[row][col];
     }
 
     ConstReference At(const SizeType& row, const SizeType& col) const
         // Константный At.
     {
-        detail::RangeCheck(*this, row, col);
+        detail::RangeCheck(*this, row, col, static_cast<std::string>("Matrix"));
         return this->PMem_data[row][col];
     }
 
@@ -691,6 +842,286 @@ inline auto operator*(const T& lhs, const Matrix<U>& rhs) -> Matrix<decltype(lhs
     return rhs * lhs;
 }
 
+template<typename T, typename U, typename V>
+void Gemm(const typename Matrix<T>::ValueType& alpha, const Matrix<U>& a, bool transposeA,
+          const Matrix<V>& b, bool transposeB, const typename Matrix<T>::ValueType& beta, Matrix<T>& c)
+    /* Функция Gemm (как в BLAS-3). Вычисляет c = alpha * op(a) * op(b) + beta * c, где op(x) - это
+       x, или x транспонированная, если установлен флаг transpose. Результат записывается в уже
+       созданную матрицу c, т.е. новая память не выделяется. Транспонированные операнды
+       не копируются (Transpose() не вызывается), а читаются по столбцам.
+       T выводится только из c, alpha и beta приводятся к нему (Gemm(1, a, false, b, false, 0, c)) */
+{
+    detail::CheckGemmPossiblity(a, transposeA, b, transposeB, c);
+    typedef typename Matrix<T>::SizeType SizeType;
+    const SizeType rows = c.Rows();
+    const SizeType cols = c.Columns();
+    const SizeType inner = transposeA ? a.Rows() : a.Columns();
+    const U* const* aData = a.Data();
+    const V* const* bData = b.Data();
+    typedef decltype(U() * V()) ProductType; // Тип произведения элементов a и b (как в operator*)
+
+    if (!transposeB && std::is_same<T, ProductType>::value)
+        /* Если произведение уже имеет тип T, то c можно накапливать прямо в c: порядок циклов
+           i-k-j, строка b и строка c проходятся последовательно, а элемент op(a) выносится
+           из внутреннего цикла. Сначала c = beta * c */
+    {
+        for (SizeType i = 0; i < rows; i++)
+        {
+            T* cRow = c.Data(i);
+            if (beta == static_cast<T>(0))
+                // Как и в BLAS, при beta == 0 старые значения c не читаются (там может быть мусор)
+            {
+                for (SizeType j = 0; j < cols; j++)
+                {
+                    cRow[j] = static_cast<T>(0);
+                }
+            }
+            else if (beta != static_cast<T>(1))
+            {
+                for (SizeType j = 0; j < cols; j++)
+                {
+                    cRow[j] *= beta;
+                }
+            }
+        }
+        if (alpha == static_cast<T>(0))
+        {
+            return;
+        }
+        for (SizeType i = 0; i < rows; i++)
+        {
+            T* cRow = c.Data(i);
+            for (SizeType k = 0; k < inner; k++)
+            {
+                const T aik = static_cast<T>(alpha * (transposeA ? aData[k][i] : aData[i][k]));
+                if (aik == static_cast<T>(0))
+                {
+                    continue;
+                }
+                const V* bRow = bData[k];
+                for (SizeType j = 0; j < cols; j++)
+                {
+                    cRow[j] += static_cast<T>(aik * bRow[j]);
+                }
+            }
+        }
+        return;
+    }
+
+    /* Иначе c[i][j] - это скалярное произведение строки op(a) на столбец op(b) (при transposeB
+       это строка b[j]). Сумма накапливается в ProductType и приводится к T один раз, вместе
+       с alpha и beta, поэтому результат не зависит от флагов транспонирования */
+    for (SizeType i = 0; i < rows; i++)
+    {
+        T* cRow = c.Data(i);
+        for (SizeType j = 0; j < cols; j++)
+        {
+            ProductType sum = ProductType();
+            if (alpha != static_cast<T>(0))
+            {
+                for (SizeType k = 0; k < inner; k++)
+                {
+                    sum += (transposeA ? aData[k][i] : aData[i][k]) *
+                           (transposeB ? bData[j][k] : bData[k][j]);
+                }
+            }
+            if (beta == static_cast<T>(0)) // См. комментарий выше про beta == 0
+            {
+                cRow[j] = static_cast<T>(alpha * sum);
+            }
+            else
+            {
+                cRow[j] = static_cast<T>(alpha * sum + beta * cRow[j]);
+            }
+        }
+    }
+}
+
+namespace detail
+    // Служебные функции для MultiplyChain. Вынесены сюда т.к. используют Gemm
+{
+    template<typename T>
+    std::size_t AcquireBuffer(std::vector<Matrix<T> >& pool, std::vector<bool>& busy,
+                              const std::size_t& rows, const std::size_t& cols)
+        /* Возвращает индекс свободного буфера из pool размера rows на cols, а если такого нет -
+           создаёт его прямо в pool. Память под pool резервируется заранее (см. MultiplyChain),
+           поэтому ссылки на буферы не становятся недействительными */
+    {
+        for (std::size_t i = 0; i < pool.size(); i++)
+        {
+            if (!busy[i] && pool[i].Rows() == rows && pool[i].Columns() == cols)
+            {
+                busy[i] = true;
+                return i;
+            }
+        }
+        pool.emplace_back(rows, cols);
+        busy.push_back(true);
+        return pool.size() - 1;
+    }
+
+    template<typename T>
+    void MultiplyChainRange(const std::vector<const Matrix<T>*>& chain,
+                            const std::vector<std::vector<std::size_t> >& split,
+                            const std::size_t& first, const std::size_t& last, Matrix<T>& product,
+                            std::vector<Matrix<T> >& pool, std::vector<bool>& busy)
+        /* Записывает в product (уже нужного размера) произведение chain[first..last],
+           расставляя скобки по таблице split. Промежуточные результаты берутся из pool */
+    {
+        const std::size_t middle = split[first][last];
+        const Matrix<T>* lhs = chain[first];
+        const Matrix<T>* rhs = chain[last];
+        std::size_t lhsBuffer = 0, rhsBuffer = 0;
+        if (middle > first)
+        {
+            lhsBuffer = AcquireBuffer(pool, busy, chain[first]->Rows(), chain[middle]->Columns());
+            MultiplyChainRange(chain, split, first, middle, pool[lhsBuffer], pool, busy);
+            lhs = &pool[lhsBuffer];
+        }
+        if (middle + 1 < last)
+        {
+            rhsBuffer = AcquireBuffer(pool, busy, chain[middle + 1]->Rows(), chain[last]->Columns());
+            MultiplyChainRange(chain, split, middle + 1, last, pool[rhsBuffer], pool, busy);
+            rhs = &pool[rhsBuffer];
+        }
+        Gemm(static_cast<T>(1), *lhs, false, *rhs, false, static_cast<T>(0), product);
+        if (middle > first) // Буферы освобождаются, содержимое больше не нужно
+        {
+            busy[lhsBuffer] = false;
+        }
+        if (middle + 1 < last)
+        {
+            busy[rhsBuffer] = false;
+        }
+    }
+} // namespace detail
+
+template<typename T>
+Matrix<T> MultiplyChain(const std::vector<const Matrix<T>*>& chain)
+    /* Функция MultiplyChain. Перемножает цепочку матриц (chain[0] * chain[1] * ...), но расставляет
+       скобки так, чтобы кол-во умножений было минимальным. Матрицы передаются указателями,
+       поэтому длину цепочки можно выбирать во время выполнения, и ничего не копируется.
+       Классическое динамическое программирование по размерам матриц: cost[i][j] - минимальное
+       кол-во умножений для chain[i..j], split[i][j] - после какой матрицы ставить скобку.
+       Промежуточные результаты переиспользуются, если совпадает размер */
+{
+    detail::CheckMultiplyChainPossiblity(chain);
+    const std::size_t count = chain.size();
+    if (count == 1)
+    {
+        return *chain[0];
+    }
+    std::vector<std::size_t> dims(count + 1); // chain[i] имеет размер dims[i] на dims[i + 1]
+    for (std::size_t i = 0; i < count; i++)
+    {
+        dims[i] = chain[i]->Rows();
+    }
+    dims[count] = chain[count - 1]->Columns();
+
+    std::vector<std::vector<unsigned long long> > cost(count, std::vector<unsigned long long>(count, 0));
+    std::vector<std::vector<std::size_t> > split(count, std::vector<std::size_t>(count, 0));
+    for (std::size_t length = 2; length <= count; length++)
+    {
+        for (std::size_t i = 0; i + length <= count; i++)
+        {
+            const std::size_t j = i + length - 1;
+            for (std::size_t k = i; k < j; k++)
+            {
+                const unsigned long long candidate = cost[i][k] + cost[k + 1][j] +
+                    static_cast<unsigned long long>(dims[i]) * dims[k + 1] * dims[j + 1];
+                if (k == i || candidate < cost[i][j])
+                {
+                    cost[i][j] = candidate;
+                    split[i][j] = k;
+                }
+            }
+        }
+    }
+
+    Matrix<T> product(dims[0], dims[count]);
+    std::vector<Matrix<T> > pool; // Промежуточных результатов не больше, чем count - 2
+    std::vector<bool> busy;
+    pool.reserve(count);
+    busy.reserve(count);
+    detail::MultiplyChainRange(chain, split, 0, count - 1, product, pool, busy);
+    return product;
+}
+
+template<typename T>
+Matrix<T> MultiplyChain(std::initializer_list<std::reference_wrapper<const Matrix<T> > > chain)
+    /* MultiplyChain (2 перегрузка). Принимает список матриц: MultiplyChain<double>({a, b, c}).
+       T нужно указать явно, т.к. из {a, b, c} он не выводится */
+{
+    std::vector<const Matrix<T>*> pointers;
+    pointers.reserve(chain.size());
+    for (const Matrix<T>& matrix : chain)
+    {
+        pointers.push_back(&matrix);
+    }
+    return MultiplyChain(pointers);
+}
+
+template<typename T, typename... Rest>
+Matrix<T> MultiplyChain(const Matrix<T>& first, const Rest&... rest)
+    /* MultiplyChain (3 перегрузка). MultiplyChain(a, b, c, d) == a * b * c * d, когда длина
+       цепочки известна при компиляции. Все матрицы должны иметь одинаковый тип */
+{
+    const std::vector<const Matrix<T>*> chain = { &first, &rest... };
+    return MultiplyChain(chain);
+}
+
+template<typename T>
+Matrix<T> Power(const Matrix<T>& matrix, std::size_t exponent)
+    /* Функция Power. Возводит квадратную матрицу в степень exponent быстрым возведением в степень.
+       Независимо от exponent создаётся всего 3 матрицы: result и base по очереди пишут
+       произведение в scratch и меняются с ним местами через Swap */
+{
+    detail::CheckPowerPossiblity(matrix);
+    const std::size_t size = matrix.Rows();
+    Matrix<T> result(size, size);
+    if (exponent == 0) // Нулевая степень - единичная матрица
+    {
+        for (std::size_t i = 0; i < size; i++)
+        {
+            result[i][i] = static_cast<T>(1);
+        }
+        return result;
+    }
+    Matrix<T> base(matrix);
+    Matrix<T> scratch(size, size);
+    bool resultIsIdentity = true; // Чтобы не умножать на единичную матрицу
+    while (true)
+    {
+        if (exponent & 1)
+        {
+            if (resultIsIdentity)
+            {
+                for (std::size_t i = 0; i < size; i++)
+                {
+                    for (std::size_t j = 0; j < size; j++)
+                    {
+                        result[i][j] = base[i][j];
+                    }
+                }
+                resultIsIdentity = false;
+            }
+            else
+            {
+                Gemm(static_cast<T>(1), result, false, base, false, static_cast<T>(0), scratch);
+                result.Swap(scratch);
+            }
+        }
+        exponent >>= 1;
+        if (exponent == 0) // Последнее возведение base в квадрат не нужно
+        {
+            break;
+        }
+        Gemm(static_cast<T>(1), base, false, base, false, static_cast<T>(0), scratch);
+        base.Swap(scratch);
+    }
+    return result;
+}
+
 
 template<typename T>
 inline void Swap(Matrix<T>& x, Matrix<T>& y)
@@ -699,4 +1130,455 @@ inline void Swap(Matrix<T>& x, Matrix<T>& y)
     x.Swap(y);
 }
 
+class BitMatrix; // См. объявление Matrix
+
+namespace detail
+    // Служебные функции для BitMatrix
+{
+    const std::size_t BitMatrixWordBits = 64; // Кол-во элементов BitMatrix в одном слове
+
+    inline std::size_t PopCount(std::uint64_t word) noexcept
+        // Функция PopCount. Возвращает кол-во единичных битов в word
+    {
+#if defined(__GNUC__)
+        return static_cast<std::size_t>(__builtin_popcountll(word));
+#elif defined(_MSC_VER) && defined(_M_X64)
+        return static_cast<std::size_t>(__popcnt64(word));
+#else // Если встроенной функции нет
+        word = word - ((word >> 1) & 0x5555555555555555ULL);
+        word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+        word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        return static_cast<std::size_t>((word * 0x0101010101010101ULL) >> 56);
+#endif // defined(__GNUC__)
+    }
+
+    // Проверки для BitMatrix. Определены после класса, т.к. им нужны его методы
+    inline void CheckBitMatrixMultiplicationPossiblity(const BitMatrix& x, const BitMatrix& y,
+                                                       const std::string& whatOperator);
+    inline void CheckTransitiveClosurePossiblity(const BitMatrix& matrix);
+} // namespace detail
+
+class BitMatrix
+    /* Класс BitMatrix. Булева матрица, в которой каждый элемент занимает 1 бит (64 элемента
+       в одном слове). Умножение выполняется над полукольцом (ИЛИ, И), т.е. результат тоже
+       булева матрица, в отличие от Matrix<bool>, где operator* даёт Matrix<int>.
+       Биты строки за пределами Columns() всегда равны 0 (на это полагаются Count и operator==) */
+{
+public:
+    // typedef'ы
+    typedef std::uint64_t       WordType;
+    typedef WordType*           Pointer;
+    typedef const WordType*     ConstPointer;
+    typedef std::size_t         SizeType;
+private:
+    SizeType PMem_rows; // Кол-во строк в матрице
+    SizeType PMem_columns; // Кол-во столбцов в матрице
+    SizeType PMem_words; // Кол-во слов в строке
+    WordType** PMem_data; // Сама матрица (строки из PMem_words слов)
+
+    WordType PMem_TailMask() const noexcept
+        // Маска значащих битов последнего слова строки
+    {
+        const SizeType tail = this->PMem_columns % detail::BitMatrixWordBits;
+        return tail == 0 ? ~static_cast<WordType>(0) : (static_cast<WordType>(1) << tail) - 1;
+    }
+public:
+    BitMatrix(const SizeType& rows = 0, const SizeType& cols = 0, bool initValue = false)
+        // Стандартный конструктор
+        : PMem_rows(rows), PMem_columns(cols),
+          PMem_words((cols + detail::BitMatrixWordBits - 1) / detail::BitMatrixWordBits)
+    {
+        if ((rows == 0) ^ (cols == 0)) // См. конструктор Matrix
+        {
+#ifdef _MSC_VER
+            _STL_REPORT_ERROR("Bad BitMatrix size. In BitMatrix mustn't be 0 rows xor 0 columns");
+#else // Если используется другой компилятор (не Microsoft)
+            throw std::length_error("In BitMatrix constructor: In BitMatrix mustn't be 0 rows xor 0 columns\n"
+                                    "rows == 0 ^ cols == 0 must be false.");
+#endif // _MSC_VER
+        }
+        detail::CreateDM(this->PMem_data, rows, this->PMem_words);
+        const WordType fill = initValue ? ~static_cast<WordType>(0) : static_cast<WordType>(0);
+        for (SizeType i = 0; i < rows; i++) // Инициализация data
+        {
+            for (SizeType w = 0; w < this->PMem_words; w++)
+            {
+                this->PMem_data[i][w] = fill;
+            }
+            if (this->PMem_words != 0)
+            {
+                this->PMem_data[i][this->PMem_words - 1] &= this->PMem_TailMask();
+            }
+        }
+    }
+
+    explicit BitMatrix(const Matrix<bool>& matrix)
+        // Конструктор от Matrix<bool>
+        : BitMatrix(matrix.Rows(), matrix.Columns())
+    {
+        for (SizeType i = 0; i < this->PMem_rows; i++)
+        {
+            for (SizeType j = 0; j < this->PMem_columns; j++)
+            {
+                if (matrix[i][j])
+                {
+                    this->PMem_data[i][j / detail::BitMatrixWordBits] |=
+                        static_cast<WordType>(1) << (j % detail::BitMatrixWordBits);
+                }
+            }
+        }
+    }
+
+    BitMatrix(const BitMatrix& other)
+        // Конструктор копирования
+        : PMem_rows(other.PMem_rows), PMem_columns(other.PMem_columns), PMem_words(other.PMem_words)
+    {
+        detail::CreateDM(this->PMem_data, this->PMem_rows, this->PMem_words);
+        detail::InitializeDM(this->PMem_data, other.PMem_data, this->PMem_rows, this->PMem_words);
+    }
+
+    BitMatrix& operator=(const BitMatrix& whatAssign)
+        // Оператор присваивания. Реализован при помощи Swap
+    {
+        if (this != &whatAssign)
+        {
+            BitMatrix(whatAssign).Swap(*this);
+        }
+        return *this;
+    }
+
+    BitMatrix(BitMatrix&& other) noexcept
+        // Перемещающий конструктор. Реализован при помощи Swap
+        : PMem_rows(0), PMem_columns(0), PMem_words(0), PMem_data(nullptr)
+    {
+        this->Swap(other);
+    }
+
+    BitMatrix& operator=(BitMatrix&& whatMove) noexcept
+        /* Перемещающий оператор присваивания. Старые данные this уходят в whatMove
+           и удаляются вместе с ним */
+    {
+        this->Swap(whatMove);
+        return *this;
+    }
+
+    ~BitMatrix() noexcept
+        // Деструктор
+    {
+        detail::EliminateDM(this->PMem_data, this->PMem_rows);
+    }
+
+
+
+    bool Get(const SizeType& row, const SizeType& col) const noexcept
+        // Метод Get. Возвращает элемент (без проверки границ)
+    {
+        return ((this->PMem_data[row][col / detail::BitMatrixWordBits] >>
+                 (col % detail::BitMatrixWordBits)) & 1) != 0;
+    }
+
+    void Set(const SizeType& row, const SizeType& col, bool value) noexcept
+        // Метод Set. Устанавливает элемент (без проверки границ)
+    {
+        const WordType bit = static_cast<WordType>(1) << (col % detail::BitMatrixWordBits);
+        if (value)
+        {
+            this->PMem_data[row][col / detail::BitMatrixWordBits] |= bit;
+        }
+        else
+        {
+            this->PMem_data[row][col / detail::BitMatrixWordBits] &= ~bit;
+        }
+    }
+
+    bool At(const SizeType& row, const SizeType& col) const
+        // Метод At. Безопасная, но медленная замена Get
+    {
+        detail::RangeCheck(*this, row, col, static_cast<std::string>("BitMatrix"));
+        return this->Get(row, col);
+    }
+
+
+
+    void Swap(BitMatrix& rhs) noexcept
+        // Метод Swap. Меняет this и rhs местами.
+    {
+        std::swap(this->PMem_data, rhs.PMem_data);
+        std::swap(this->PMem_rows, rhs.PMem_rows);
+        std::swap(this->PMem_columns, rhs.PMem_columns);
+        std::swap(this->PMem_words, rhs.PMem_words);
+    }
+
+    bool Empty() const noexcept
+        // Метод Empty. Проверяет, пуста ли матрица
+    {
+        return (this->PMem_rows == 0) && (this->PMem_columns == 0);
+    }
+
+    SizeType Count() const noexcept
+        // Метод Count. Возвращает кол-во единичных элементов
+    {
+        SizeType count = 0;
+        for (SizeType i = 0; i < this->PMem_rows; i++)
+        {
+            for (SizeType w = 0; w < this->PMem_words; w++)
+            {
+                count += detail::PopCount(this->PMem_data[i][w]);
+            }
+        }
+        return count;
+    }
+
+    Matrix<bool> ToMatrix() const
+        // Метод ToMatrix. Распаковывает BitMatrix в Matrix<bool>
+    {
+        Matrix<bool> unpacked(this->PMem_rows, this->PMem_columns, false);
+        for (SizeType i = 0; i < this->PMem_rows; i++)
+        {
+            for (SizeType j = 0; j < this->PMem_columns; j++)
+            {
+                unpacked[i][j] = this->Get(i, j);
+            }
+        }
+        return unpacked;
+    }
+
+    void TransitiveClosure()
+        /* Метод TransitiveClosure. Заменяет матрицу смежности графа её транзитивным замыканием
+           (алгоритм Уоршелла): если вершина k достижима из i, то к строке i добавляется
+           (через ИЛИ) вся строка k, по 64 элемента за операцию. Матрица должна быть квадратной */
+    {
+        detail::CheckTransitiveClosurePossiblity(*this);
+        for (SizeType k = 0; k < this->PMem_rows; k++)
+        {
+            const SizeType wordK = k / detail::BitMatrixWordBits;
+            const WordType bitK = static_cast<WordType>(1) << (k % detail::BitMatrixWordBits);
+            const WordType* rowK = this->PMem_data[k];
+            for (SizeType i = 0; i < this->PMem_rows; i++)
+            {
+                WordType* rowI = this->PMem_data[i];
+                if ((rowI[wordK] & bitK) != 0)
+                {
+                    for (SizeType w = 0; w < this->PMem_words; w++)
+                    {
+                        rowI[w] |= rowK[w];
+                    }
+                }
+            }
+        }
+    }
+
+
+    SizeType Rows() const noexcept
+        // Метод Rows. Вовращает кол-во строк в матрице
+    {
+        return this->PMem_rows;
+    }
+
+    SizeType Columns() const noexcept
+        // Метод Columns. Вовращает кол-во столбцов в матрице
+    {
+        return this->PMem_columns;
+    }
+
+    SizeType WordsPerRow() const noexcept
+        // Метод WordsPerRow. Возвращает кол-во слов в строке
+    {
+        return this->PMem_words;
+    }
+
+    Pointer Data(SizeType idx) noexcept
+        // Метод Data. Возвращает адрес строки под индексом idx (младший бит слова - меньший столбец)
+    {
+        return this->PMem_data[idx];
+    }
+
+    ConstPointer Data(SizeType idx) const noexcept
+        // Константный Data
+    {
+        return this->PMem_data[idx];
+    }
+};
+
+namespace detail
+{
+    inline void CheckBitMatrixMultiplicationPossiblity(const BitMatrix& x, const BitMatrix& y,
+                                                       const std::string& whatOperator)
+        /* Аналог CheckMatrix_matrixMultiplicationPossiblity для BitMatrix (проверка на
+           арифметичность не нужна) */
+    {
+        if (x.Columns() != y.Rows())
+        {
+#ifdef _MSC_VER
+            _STL_REPORT_ERROR("Wrong matrices size (to use operator" + whatOperator +
+                              " columns of \"x\" must be equal to \"y\" rows).");
+#else // Если используется не компилятор Microsoft
+            throw std::invalid_argument("In operator" + whatOperator + ": x.Columns() "
+                                        "is not equal to y.Rows(). "
+                                        "(It must be equal).");
+#endif // _MSC_VER
+        }
+        if (x.Rows() == 0 || y.Rows() == 0) // см. CheckArithmeticOperationPossiblity
+        {
+#ifdef _MSC_VER
+            _STL_REPORT_ERROR("Marix have null size. To use operator" + whatOperator +
+                              " Matrix's size mustn't be null");
+#else
+            throw std::invalid_argument("In operator" + whatOperator + ": Matrix have null size."
+                                        " (Matrix's size mustn't be null).");
+#endif
+        }
+    }
+
+    inline void CheckTransitiveClosurePossiblity(const BitMatrix& matrix)
+        // Проверяет, можно ли построить транзитивное замыкание (см. BitMatrix::TransitiveClosure)
+    {
+        if (matrix.Rows() != matrix.Columns())
+        {
+#ifdef _MSC_VER
+            _STL_REPORT_ERROR("Wrong BitMatrix size (to use TransitiveClosure matrix must be square).");
+#else // Если используется не компилятор Microsoft
+            throw std::invalid_argument("In BitMatrix::TransitiveClosure: Rows() is not equal to Columns(). "
+                                        "(Matrix must be square).");
+#endif // _MSC_VER
+        }
+    }
+} // namespace detail
+
+inline bool operator==(const BitMatrix& lhs, const BitMatrix& rhs)
+    // Оператор ==. Сравнивает матрицы по словам (биты за пределами Columns() всегда равны 0)
+{
+    if (lhs.Rows() != rhs.Rows() || lhs.Columns() != rhs.Columns())
+    {
+        return false;
+    }
+    for (std::size_t i = 0; i < lhs.Rows(); i++)
+    {
+        for (std::size_t w = 0; w < lhs.WordsPerRow(); w++)
+        {
+            if (lhs.Data(i)[w] != rhs.Data(i)[w])
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+inline bool operator!=(const BitMatrix& lhs, const BitMatrix& rhs)
+    // Оператор !=
+{
+    return !(lhs == rhs);
+}
+
+inline BitMatrix operator*(const BitMatrix& lhs, const BitMatrix& rhs)
+    /* Оператор *. Булево умножение: product[i][j] = ИЛИ по k (lhs[i][k] И rhs[k][j]).
+       Строка product[i] - это ИЛИ тех строк rhs, номера которых отмечены в строке lhs[i].
+       Используется метод четырёх русских: строки rhs берутся блоками по 8, для блока заранее
+       считаются все 256 их ИЛИ-комбинаций, и затем на каждый байт строки lhs приходится одно
+       ИЛИ готовой строки вместо нескольких. Таблица строится только для тех блоков,
+       где она окупается при фактической плотности lhs */
+{
+    typedef BitMatrix::WordType WordType;
+    detail::CheckBitMatrixMultiplicationPossiblity(lhs, rhs, static_cast<std::string>("*"));
+    const std::size_t rows = lhs.Rows();
+    const std::size_t inner = lhs.Columns();
+    const std::size_t words = rhs.WordsPerRow();
+    BitMatrix product(rows, rhs.Columns());
+
+    const std::size_t blockBits = 8; // Размер блока строк rhs (таблица из 2^8 строк)
+    std::vector<WordType> table; // Выделяется, только если хотя бы одному блоку она нужна
+    for (std::size_t base = 0; base < inner; base += blockBits)
+    {
+        const std::size_t bits = (inner - base < blockBits) ? inner - base : blockBits;
+        // base кратен 8, поэтому байт не пересекает границу слова
+        const std::size_t lhsWord = base / detail::BitMatrixWordBits;
+        const std::size_t shift = base % detail::BitMatrixWordBits;
+
+        /* Построение таблицы стоит 2^bits - 1 ИЛИ строк, а байт lhs с p установленными битами
+           экономит p - 1 ИЛИ. Поэтому сэкономленное считается по фактическим байтам lhs:
+           на разреженных графах байты почти всегда 0 или с 1 битом, и таблица не окупается */
+        std::size_t saved = 0;
+        for (std::size_t i = 0; i < rows; i++)
+        {
+            const WordType mask = (lhs.Data(i)[lhsWord] >> shift) & 0xFF;
+            if (mask != 0)
+            {
+                saved += detail::PopCount(mask) - 1;
+            }
+        }
+
+        if (saved < (static_cast<std::size_t>(1) << bits) - 1)
+            // Таблица не окупается - строки rhs складываются напрямую
+        {
+            for (std::size_t i = 0; i < rows; i++)
+            {
+                const WordType mask = (lhs.Data(i)[lhsWord] >> shift) & 0xFF;
+                if (mask == 0)
+                {
+                    continue;
+                }
+                WordType* productRow = product.Data(i);
+                for (std::size_t b = 0; b < bits; b++)
+                {
+                    if (((mask >> b) & 1) != 0)
+                    {
+                        const WordType* rhsRow = rhs.Data(base + b);
+                        for (std::size_t w = 0; w < words; w++)
+                        {
+                            productRow[w] |= rhsRow[w];
+                        }
+                    }
+                }
+            }
+            continue;
+        }
+
+        if (table.empty())
+        {
+            table.resize((static_cast<std::size_t>(1) << blockBits) * words);
+        }
+        // table[mask] = ИЛИ строк rhs[base + b] для всех битов b, установленных в mask
+        for (std::size_t w = 0; w < words; w++)
+        {
+            table[w] = 0;
+        }
+        for (std::size_t b = 0; b < bits; b++)
+        {
+            const std::size_t high = static_cast<std::size_t>(1) << b;
+            const WordType* rhsRow = rhs.Data(base + b);
+            for (std::size_t mask = 0; mask < high; mask++)
+            {
+                const WordType* from = &table[mask * words];
+                WordType* to = &table[(mask | high) * words];
+                for (std::size_t w = 0; w < words; w++)
+                {
+                    to[w] = from[w] | rhsRow[w];
+                }
+            }
+        }
+        for (std::size_t i = 0; i < rows; i++)
+        {
+            const std::size_t mask = static_cast<std::size_t>((lhs.Data(i)[lhsWord] >> shift) & 0xFF);
+            if (mask == 0)
+            {
+                continue;
+            }
+            const WordType* from = &table[mask * words];
+            WordType* productRow = product.Data(i);
+            for (std::size_t w = 0; w < words; w++)
+            {
+                productRow[w] |= from[w];
+            }
+        }
+    }
+    return product;
+}
+
+inline void Swap(BitMatrix& x, BitMatrix& y) noexcept
+    // См. BitMatrix::Swap()
+{
+    x.Swap(y);
+}
+
 #endif /* MATRIX_HPP */